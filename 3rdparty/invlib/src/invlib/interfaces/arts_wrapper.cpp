@@ -12,7 +12,7 @@ ArtsVector::ArtsVector(ArtsVector &&v)
 auto ArtsVector::operator=(ArtsVector &&v)
     -> ArtsVector &
 {
-    delete[] this->mdata;
+    matpack_free(this->mdata);
     this->mrange  = v.mrange;
     this->mdata   = v.mdata;
     v.mdata       = nullptr;
@@ -99,7 +99,7 @@ ArtsMatrix::ArtsMatrix(ArtsMatrix &&A)
 auto ArtsMatrix::operator=(ArtsMatrix &&A)
     -> ArtsMatrix &
 {
-    delete[] this->mdata;
+    matpack_free(this->mdata);
     this->mcr  = A.mcr;
     this->mrr  = A.mrr;
     this->mdata   = A.mdata;
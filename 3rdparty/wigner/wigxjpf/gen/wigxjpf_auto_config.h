@@ -0,0 +1,7 @@
+/* Autogenerated: test TEST_LONG_DOUBLE - editing is useless! */
+#define WIGXJPF_IMPL_LONG_DOUBLE 1
+/* Autogenerated: test TEST_FLOAT128 - editing is useless! */
+/* Autogenerated: test TEST_THREAD - editing is useless! */
+#define WIGXJPF_HAVE_THREAD 1
+/* Autogenerated: test TEST_UINT128 - editing is useless! */
+#define MULTI_WORD_INT_SIZEOF_ITEM 8